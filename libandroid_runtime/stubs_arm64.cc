@@ -15,6 +15,8 @@
 //
 
 // clang-format off
+#include <android/api-level.h>
+
 #include "native_bridge_support/vdso/interceptable_functions.h"
 
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(_Z17get_native_cameraP7_JNIEnvP8_jobjectPP16JNICameraContext);
@@ -980,6 +982,19 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(crypto_scrypt);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(registerFrameworkNatives);
 
 static void __attribute__((constructor(0))) init_stub_library() {
+  // Only apps targeting below N may use libandroid_runtime (see
+  // kPathTranslationN in the linker). Other apps only load it as a dependency
+  // of other stub libraries, which never call it, so skip registering.
+  //
+  // Skipping can't be undone, and an unregistered stub jumps to address 0.
+  // So only skip once the runtime has set the target SDK. Until then it reads
+  // as __ANDROID_API_FUTURE__, and a library loaded that early registers
+  // everything as before.
+  int target_sdk_version = android_get_application_target_sdk_version();
+  if (target_sdk_version >= __ANDROID_API_N__ && target_sdk_version != __ANDROID_API_FUTURE__) {
+    return;
+  }
+
   INIT_INTERCEPTABLE_STUB_FUNCTION("libandroid_runtime.so", _Z17get_native_cameraP7_JNIEnvP8_jobjectPP16JNICameraContext);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libandroid_runtime.so", _Z19_set_seccomp_filter10FilterType);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libandroid_runtime.so", _Z22get_device_from_objectP7_JNIEnvP8_jobject);
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <jni.h>
+#include <pthread.h>
+#include <stdint.h>
+
+#include <atomic>
+
+// The JniConstants_* accessors return global class references and field and
+// method IDs that libnativehelper looks up once and keeps until
+// jniUninitializeConstants(). Remember them in the guest so that only the
+// first call for each goes to the host.
+
+namespace {
+
+// Cleared by jniUninitializeConstants().
+#define CACHED_JNI_CONSTANTS(V)                    \
+  V(jclass, FileDescriptorClass)                   \
+  V(jfieldID, FileDescriptor_descriptor)           \
+  V(jmethodID, FileDescriptor_init)                \
+  V(jclass, NIOAccessClass)                        \
+  V(jmethodID, NIOAccess_getBaseArray)             \
+  V(jmethodID, NIOAccess_getBaseArrayOffset)       \
+  V(jclass, NioBufferClass)                        \
+  V(jfieldID, NioBuffer__elementSizeShift)         \
+  V(jfieldID, NioBuffer_address)                   \
+  V(jmethodID, NioBuffer_array)                    \
+  V(jmethodID, NioBuffer_arrayOffset)              \
+  V(jfieldID, NioBuffer_limit)                     \
+  V(jfieldID, NioBuffer_position)
+
+#define DEFINE_CACHE(type, name) std::atomic<type> g_##name;
+CACHED_JNI_CONSTANTS(DEFINE_CACHE)
+#undef DEFINE_CACHE
+
+// Guards storing into the caches and the two counters below. A value is only
+// stored if no jniUninitializeConstants() overlapped its host call, since it
+// could be a reference the host has just released.
+pthread_mutex_t g_store_lock = PTHREAD_MUTEX_INITIALIZER;
+// Incremented as each jniUninitializeConstants() starts.
+uint32_t g_generation;
+// Number of jniUninitializeConstants() calls in progress.
+uint32_t g_uninitializing;
+
+template <typename T, typename HostAccessor>
+T GetCached(std::atomic<T>* cache, JNIEnv* env, HostAccessor host_accessor) {
+  T value = cache->load(std::memory_order_acquire);
+  if (value == nullptr) {
+    pthread_mutex_lock(&g_store_lock);
+    bool keep = g_uninitializing == 0;
+    uint32_t generation = g_generation;
+    pthread_mutex_unlock(&g_store_lock);
+
+    // Racing threads get the same value from the host.
+    value = host_accessor(env);
+
+    pthread_mutex_lock(&g_store_lock);
+    if (keep && generation == g_generation) {
+      cache->store(value, std::memory_order_release);
+    }
+    pthread_mutex_unlock(&g_store_lock);
+  }
+  return value;
+}
+
+void BeginUninitialize() {
+  pthread_mutex_lock(&g_store_lock);
+  ++g_generation;
+  ++g_uninitializing;
+#define CLEAR_CACHE(type, name) g_##name.store(nullptr, std::memory_order_release);
+  CACHED_JNI_CONSTANTS(CLEAR_CACHE)
+#undef CLEAR_CACHE
+  pthread_mutex_unlock(&g_store_lock);
+}
+
+void EndUninitialize() {
+  pthread_mutex_lock(&g_store_lock);
+  --g_uninitializing;
+  pthread_mutex_unlock(&g_store_lock);
+}
+
+}  // namespace
+
+#define DEFINE_CACHED_ACCESSOR(type, name)                                    \
+  extern "C" type native_bridge_host_JniConstants_##name(JNIEnv* env);        \
+  extern "C" type JniConstants_##name(JNIEnv* env) {                          \
+    return GetCached(&g_##name, env, native_bridge_host_JniConstants_##name); \
+  }
+CACHED_JNI_CONSTANTS(DEFINE_CACHED_ACCESSOR)
+#undef DEFINE_CACHED_ACCESSOR
+
+extern "C" void native_bridge_host_jniUninitializeConstants();
+
+extern "C" void jniUninitializeConstants() {
+  BeginUninitialize();
+  native_bridge_host_jniUninitializeConstants();
+  EndUninitialize();
+}
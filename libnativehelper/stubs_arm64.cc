@@ -32,19 +32,6 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(ExpandableStringRelease);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(JNI_CreateJavaVM);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(JNI_GetCreatedJavaVMs);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(JNI_GetDefaultJavaVMInitArgs);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_FileDescriptorClass);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_FileDescriptor_descriptor);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_FileDescriptor_init);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NIOAccessClass);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NIOAccess_getBaseArray);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NIOAccess_getBaseArrayOffset);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NioBufferClass);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NioBuffer__elementSizeShift);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NioBuffer_address);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NioBuffer_array);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NioBuffer_arrayOffset);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NioBuffer_limit);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniConstants_NioBuffer_position);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniInvocationCreate);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniInvocationDestroy);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(JniInvocationGetLibrary);
@@ -67,7 +54,20 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(jniThrowExceptionFmt);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(jniThrowIOException);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(jniThrowNullPointerException);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(jniThrowRuntimeException);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(jniUninitializeConstants);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_FileDescriptorClass);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_FileDescriptor_descriptor);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_FileDescriptor_init);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NIOAccessClass);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NIOAccess_getBaseArray);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NIOAccess_getBaseArrayOffset);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NioBufferClass);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NioBuffer__elementSizeShift);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NioBuffer_address);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NioBuffer_array);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NioBuffer_arrayOffset);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NioBuffer_limit);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_JniConstants_NioBuffer_position);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_jniUninitializeConstants);
 
 static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", AFileDescriptor_create);
@@ -85,19 +85,6 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JNI_CreateJavaVM);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JNI_GetCreatedJavaVMs);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JNI_GetDefaultJavaVMInitArgs);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_FileDescriptorClass);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_FileDescriptor_descriptor);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_FileDescriptor_init);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NIOAccessClass);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NIOAccess_getBaseArray);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NIOAccess_getBaseArrayOffset);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NioBufferClass);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NioBuffer__elementSizeShift);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NioBuffer_address);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NioBuffer_array);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NioBuffer_arrayOffset);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NioBuffer_limit);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniConstants_NioBuffer_position);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniInvocationCreate);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniInvocationDestroy);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", JniInvocationGetLibrary);
@@ -120,6 +107,19 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", jniThrowIOException);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", jniThrowNullPointerException);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", jniThrowRuntimeException);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libnativehelper.so", jniUninitializeConstants);
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_FileDescriptorClass, "JniConstants_FileDescriptorClass");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_FileDescriptor_descriptor, "JniConstants_FileDescriptor_descriptor");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_FileDescriptor_init, "JniConstants_FileDescriptor_init");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NIOAccessClass, "JniConstants_NIOAccessClass");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NIOAccess_getBaseArray, "JniConstants_NIOAccess_getBaseArray");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NIOAccess_getBaseArrayOffset, "JniConstants_NIOAccess_getBaseArrayOffset");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NioBufferClass, "JniConstants_NioBufferClass");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NioBuffer__elementSizeShift, "JniConstants_NioBuffer__elementSizeShift");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NioBuffer_address, "JniConstants_NioBuffer_address");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NioBuffer_array, "JniConstants_NioBuffer_array");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NioBuffer_arrayOffset, "JniConstants_NioBuffer_arrayOffset");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NioBuffer_limit, "JniConstants_NioBuffer_limit");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_JniConstants_NioBuffer_position, "JniConstants_NioBuffer_position");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libnativehelper.so", native_bridge_host_jniUninitializeConstants, "jniUninitializeConstants");
 }
 // clang-format on
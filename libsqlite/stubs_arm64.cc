@@ -0,0 +1,509 @@
+//
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// clang-format off
+#include "native_bridge_support/vdso/interceptable_functions.h"
+
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(register_android_functions);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(register_localized_collators);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_aggregate_context);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_aggregate_count);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_auto_extension);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_backup_finish);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_backup_init);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_backup_pagecount);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_backup_remaining);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_backup_step);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_blob);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_blob64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_double);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_int);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_int64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_null);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_parameter_count);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_parameter_index);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_parameter_name);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_pointer);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_text);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_text16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_text64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_value);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_zeroblob);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_bind_zeroblob64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_blob_bytes);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_blob_close);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_blob_open);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_blob_read);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_blob_reopen);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_blob_write);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_busy_handler);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_busy_timeout);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_cancel_auto_extension);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_changes);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_clear_bindings);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_close);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_close_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_collation_needed);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_collation_needed16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_blob);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_bytes);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_bytes16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_count);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_decltype);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_decltype16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_double);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_int);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_int64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_name);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_name16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_text);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_text16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_type);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_column_value);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_commit_hook);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_complete);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_complete16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_config);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_context_db_handle);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_collation);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_collation16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_collation_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_function);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_function16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_function_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_module);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_module_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_create_window_function);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_data_count);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_db_cacheflush);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_db_config);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_db_filename);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_db_handle);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_db_mutex);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_db_readonly);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_db_release_memory);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_db_status);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_declare_vtab);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_enable_shared_cache);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_errcode);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_errmsg);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_errmsg16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_errstr);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_exec);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_expanded_sql);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_expired);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_extended_errcode);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_extended_result_codes);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_file_control);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_finalize);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_free);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_free_table);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_get_autocommit);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_get_auxdata);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_get_table);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_global_recover);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_initialize);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_interrupt);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_keyword_check);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_keyword_count);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_keyword_name);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_last_insert_rowid);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_libversion);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_libversion_number);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_limit);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_log);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_malloc);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_malloc64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_memory_alarm);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_memory_highwater);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_memory_used);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_mprintf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_msize);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_mutex_alloc);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_mutex_enter);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_mutex_free);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_mutex_leave);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_mutex_try);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_next_stmt);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_open);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_open16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_open_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_os_end);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_os_init);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_overload_function);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_prepare);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_prepare16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_prepare16_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_prepare16_v3);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_prepare_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_prepare_v3);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_profile);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_progress_handler);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_randomness);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_realloc);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_realloc64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_release_memory);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_reset);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_reset_auto_extension);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_blob);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_blob64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_double);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_error);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_error16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_error_code);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_error_nomem);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_error_toobig);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_int);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_int64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_null);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_pointer);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_subtype);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_text);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_text16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_text16be);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_text16le);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_text64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_value);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_zeroblob);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_result_zeroblob64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_rollback_hook);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_set_authorizer);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_set_auxdata);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_set_last_insert_rowid);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_shutdown);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_sleep);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_snprintf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_soft_heap_limit);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_soft_heap_limit64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_sourceid);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_sql);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_status);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_status64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_step);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_stmt_busy);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_stmt_isexplain);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_stmt_readonly);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_stmt_status);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_append);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_appendall);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_appendchar);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_appendf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_errcode);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_finish);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_length);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_new);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_reset);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_value);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_str_vappendf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_strglob);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_stricmp);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_strlike);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_strnicmp);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_system_errno);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_table_column_metadata);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_test_control);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_thread_cleanup);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_threadsafe);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_total_changes);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_trace);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_trace_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_transfer_bindings);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_update_hook);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_uri_boolean);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_uri_int64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_uri_parameter);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_user_data);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_blob);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_bytes);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_bytes16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_double);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_dup);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_free);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_frombind);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_int);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_int64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_nochange);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_numeric_type);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_pointer);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_subtype);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_text);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_text16);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_text16be);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_text16le);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_value_type);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vfs_find);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vfs_register);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vfs_unregister);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vmprintf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vsnprintf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vtab_collation);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vtab_config);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vtab_nochange);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_vtab_on_conflict);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_wal_autocheckpoint);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_wal_checkpoint);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_wal_checkpoint_v2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sqlite3_wal_hook);
+DEFINE_INTERCEPTABLE_STUB_VARIABLE(sqlite3_data_directory);
+DEFINE_INTERCEPTABLE_STUB_VARIABLE(sqlite3_temp_directory);
+DEFINE_INTERCEPTABLE_STUB_VARIABLE(sqlite3_version);
+
+static void __attribute__((constructor(0))) init_stub_library() {
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", register_android_functions);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", register_localized_collators);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_aggregate_context);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_aggregate_count);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_auto_extension);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_backup_finish);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_backup_init);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_backup_pagecount);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_backup_remaining);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_backup_step);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_blob);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_blob64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_double);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_int);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_int64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_null);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_parameter_count);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_parameter_index);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_parameter_name);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_pointer);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_text);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_text16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_text64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_value);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_zeroblob);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_bind_zeroblob64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_blob_bytes);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_blob_close);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_blob_open);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_blob_read);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_blob_reopen);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_blob_write);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_busy_handler);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_busy_timeout);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_cancel_auto_extension);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_changes);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_clear_bindings);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_close);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_close_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_collation_needed);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_collation_needed16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_blob);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_bytes);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_bytes16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_count);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_decltype);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_decltype16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_double);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_int);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_int64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_name);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_name16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_text);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_text16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_type);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_column_value);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_commit_hook);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_complete);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_complete16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_config);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_context_db_handle);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_collation);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_collation16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_collation_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_function);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_function16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_function_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_module);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_module_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_create_window_function);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_data_count);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_db_cacheflush);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_db_config);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_db_filename);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_db_handle);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_db_mutex);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_db_readonly);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_db_release_memory);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_db_status);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_declare_vtab);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_enable_shared_cache);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_errcode);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_errmsg);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_errmsg16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_errstr);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_exec);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_expanded_sql);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_expired);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_extended_errcode);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_extended_result_codes);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_file_control);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_finalize);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_free);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_free_table);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_get_autocommit);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_get_auxdata);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_get_table);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_global_recover);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_initialize);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_interrupt);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_keyword_check);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_keyword_count);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_keyword_name);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_last_insert_rowid);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_libversion);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_libversion_number);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_limit);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_log);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_malloc);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_malloc64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_memory_alarm);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_memory_highwater);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_memory_used);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_mprintf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_msize);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_mutex_alloc);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_mutex_enter);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_mutex_free);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_mutex_leave);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_mutex_try);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_next_stmt);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_open);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_open16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_open_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_os_end);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_os_init);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_overload_function);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_prepare);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_prepare16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_prepare16_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_prepare16_v3);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_prepare_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_prepare_v3);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_profile);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_progress_handler);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_randomness);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_realloc);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_realloc64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_release_memory);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_reset);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_reset_auto_extension);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_blob);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_blob64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_double);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_error);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_error16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_error_code);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_error_nomem);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_error_toobig);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_int);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_int64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_null);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_pointer);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_subtype);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_text);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_text16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_text16be);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_text16le);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_text64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_value);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_zeroblob);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_result_zeroblob64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_rollback_hook);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_set_authorizer);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_set_auxdata);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_set_last_insert_rowid);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_shutdown);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_sleep);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_snprintf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_soft_heap_limit);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_soft_heap_limit64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_sourceid);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_sql);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_status);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_status64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_step);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_stmt_busy);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_stmt_isexplain);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_stmt_readonly);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_stmt_status);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_append);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_appendall);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_appendchar);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_appendf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_errcode);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_finish);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_length);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_new);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_reset);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_value);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_str_vappendf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_strglob);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_stricmp);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_strlike);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_strnicmp);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_system_errno);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_table_column_metadata);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_test_control);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_thread_cleanup);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_threadsafe);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_total_changes);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_trace);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_trace_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_transfer_bindings);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_update_hook);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_uri_boolean);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_uri_int64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_uri_parameter);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_user_data);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_blob);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_bytes);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_bytes16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_double);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_dup);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_free);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_frombind);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_int);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_int64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_nochange);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_numeric_type);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_pointer);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_subtype);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_text);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_text16);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_text16be);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_text16le);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_value_type);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vfs_find);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vfs_register);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vfs_unregister);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vmprintf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vsnprintf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vtab_collation);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vtab_config);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vtab_nochange);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_vtab_on_conflict);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_wal_autocheckpoint);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_wal_checkpoint);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_wal_checkpoint_v2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libsqlite.so", sqlite3_wal_hook);
+  INIT_INTERCEPTABLE_STUB_VARIABLE("libsqlite.so", sqlite3_data_directory);
+  INIT_INTERCEPTABLE_STUB_VARIABLE("libsqlite.so", sqlite3_temp_directory);
+  INIT_INTERCEPTABLE_STUB_VARIABLE("libsqlite.so", sqlite3_version);
+}
+// clang-format on
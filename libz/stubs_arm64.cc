@@ -0,0 +1,193 @@
+//
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// clang-format off
+#include "native_bridge_support/vdso/interceptable_functions.h"
+
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(adler32);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(adler32_combine);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(adler32_combine64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(adler32_z);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(compress);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(compress2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(compressBound);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(crc32);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(crc32_combine);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(crc32_combine64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(crc32_z);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflate);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateBound);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateCopy);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateEnd);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateGetDictionary);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateInit2_);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateInit_);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateParams);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflatePending);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflatePrime);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateReset);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateResetKeep);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateSetDictionary);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateSetHeader);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(deflateTune);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(get_crc_table);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzbuffer);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzclearerr);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzclose);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzclose_r);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzclose_w);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzdirect);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzdopen);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzeof);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzerror);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzflush);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzfread);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzfwrite);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzgetc);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzgetc_);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzgets);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzoffset);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzoffset64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzopen);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzopen64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzprintf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzputc);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzputs);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzread);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzrewind);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzseek);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzseek64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzsetparams);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gztell);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gztell64);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzungetc);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzvprintf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(gzwrite);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflate);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateBack);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateBackEnd);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateBackInit_);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateCodesUsed);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateCopy);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateEnd);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateGetDictionary);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateGetHeader);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateInit2_);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateInit_);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateMark);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflatePrime);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateReset);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateReset2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateResetKeep);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateSetDictionary);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateSync);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateSyncPoint);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateUndermine);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(inflateValidate);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(uncompress);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(uncompress2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(zError);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(zlibCompileFlags);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(zlibVersion);
+
+static void __attribute__((constructor(0))) init_stub_library() {
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", adler32);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", adler32_combine);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", adler32_combine64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", adler32_z);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", compress);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", compress2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", compressBound);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", crc32);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", crc32_combine);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", crc32_combine64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", crc32_z);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflate);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateBound);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateCopy);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateEnd);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateGetDictionary);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateInit2_);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateInit_);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateParams);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflatePending);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflatePrime);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateReset);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateResetKeep);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateSetDictionary);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateSetHeader);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", deflateTune);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", get_crc_table);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzbuffer);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzclearerr);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzclose);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzclose_r);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzclose_w);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzdirect);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzdopen);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzeof);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzerror);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzflush);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzfread);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzfwrite);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzgetc);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzgetc_);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzgets);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzoffset);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzoffset64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzopen);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzopen64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzprintf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzputc);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzputs);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzread);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzrewind);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzseek);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzseek64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzsetparams);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gztell);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gztell64);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzungetc);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzvprintf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", gzwrite);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflate);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateBack);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateBackEnd);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateBackInit_);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateCodesUsed);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateCopy);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateEnd);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateGetDictionary);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateGetHeader);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateInit2_);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateInit_);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateMark);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflatePrime);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateReset);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateReset2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateResetKeep);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateSetDictionary);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateSync);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateSyncPoint);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateUndermine);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", inflateValidate);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", uncompress);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", uncompress2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", zError);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", zlibCompileFlags);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libz.so", zlibVersion);
+}
+// clang-format on
@@ -13,12 +13,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-
 #include "linker_translate_path.h"
 #include "linker.h"
 
 #include <android/api-level.h>
+#include <stdint.h>
+#include <string.h>
 
+#include <iterator>
 #include <string>
 
 #if defined(__arm__)
@@ -31,6 +33,115 @@
 #error "Unknown guest arch"
 #endif
 
+namespace {
+
+constexpr const char* kPathTranslation[][2] = {
+    SYSTEM_LIB("libEGL.so"),
+    SYSTEM_LIB("libGLESv1_CM.so"),
+    SYSTEM_LIB("libGLESv2.so"),
+    SYSTEM_LIB("libGLESv3.so"),
+    SYSTEM_LIB("libOpenMAXAL.so"),
+    SYSTEM_LIB("libOpenSLES.so"),
+    SYSTEM_LIB("libRS.so"),
+    SYSTEM_LIB("libaaudio.so"),
+    SYSTEM_LIB("libamidi.so"),
+    SYSTEM_LIB("libandroid.so"),
+    SYSTEM_LIB("libbinder_ndk.so"),
+    SYSTEM_LIB("libc.so"),
+    SYSTEM_LIB("libcamera2ndk.so"),
+    SYSTEM_LIB("libdl.so"),
+    SYSTEM_LIB("libjnigraphics.so"),
+    SYSTEM_LIB("liblog.so"),
+    SYSTEM_LIB("libm.so"),
+    SYSTEM_LIB("libmediandk.so"),
+    SYSTEM_LIB("libnativewindow.so"),
+    SYSTEM_LIB("libstdc++.so"),
+    SYSTEM_LIB("libsync.so"),
+    SYSTEM_LIB("libvulkan.so"),
+    SYSTEM_LIB("libwebviewchromium_plat_support.so"),
+    SYSTEM_LIB("libz.so")};
+
+constexpr const char* kPathTranslationQ[][2] = {
+    SYSTEM_LIB("libicui18n.so"), SYSTEM_LIB("libicuuc.so"), SYSTEM_LIB("libneuralnetworks.so")};
+
+// Libraries from greylist.  Only convert these for apps targeting N or below.
+constexpr const char* kPathTranslationN[][2] = {SYSTEM_LIB("libandroid_runtime.so"),
+                                                SYSTEM_LIB("libbinder.so"),
+                                                SYSTEM_LIB("libcrypto.so"),
+                                                SYSTEM_LIB("libcutils.so"),
+                                                SYSTEM_LIB("libexpat.so"),
+                                                SYSTEM_LIB("libgui.so"),
+                                                SYSTEM_LIB("libmedia.so"),
+                                                SYSTEM_LIB("libnativehelper.so"),
+                                                SYSTEM_LIB("libssl.so"),
+                                                SYSTEM_LIB("libstagefright.so"),
+                                                SYSTEM_LIB("libsqlite.so"),
+                                                SYSTEM_LIB("libui.so"),
+                                                SYSTEM_LIB("libutils.so"),
+                                                SYSTEM_LIB("libvorbisidec.so")};
+
+// Translations from kPathTranslation apply regardless of the target SDK.
+constexpr int kAnyTargetSdk = __ANDROID_API_FUTURE__;
+
+// dlopen() consults the translation tables for every requested name, and most
+// names are not there. Merge the tables into an open addressing hash table at
+// compile time so that both hits and misses take a single probe sequence.
+struct PathTranslationEntry {
+  // {system path, apex path}, nullptr for an empty slot.
+  const char* const* translation;
+  uint32_t hash;
+  // Translate only for apps targeting an SDK below this one.
+  int target_sdk_limit;
+};
+
+// Must be a power of two, and keep the load factor low to make probing short.
+constexpr size_t kPathTranslationSlots = 128;
+
+static_assert(std::size(kPathTranslation) + std::size(kPathTranslationQ) +
+                      std::size(kPathTranslationN) <=
+                  kPathTranslationSlots / 2,
+              "path translation hash table is too full");
+
+struct PathTranslationTable {
+  PathTranslationEntry slots[kPathTranslationSlots];
+};
+
+// FNV-1a.
+constexpr uint32_t HashPath(const char* path) {
+  uint32_t hash = 2166136261u;
+  for (; *path != '\0'; ++path) {
+    hash ^= static_cast<uint8_t>(*path);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+template <size_t N>
+constexpr void AddPathTranslations(PathTranslationTable& table,
+                                   const char* const (&translations)[N][2],
+                                   int target_sdk_limit) {
+  for (size_t i = 0; i < N; ++i) {
+    uint32_t hash = HashPath(translations[i][0]);
+    size_t slot = hash & (kPathTranslationSlots - 1);
+    while (table.slots[slot].translation != nullptr) {
+      slot = (slot + 1) & (kPathTranslationSlots - 1);
+    }
+    table.slots[slot] = {translations[i], hash, target_sdk_limit};
+  }
+}
+
+constexpr PathTranslationTable BuildPathTranslationTable() {
+  PathTranslationTable table{};
+  AddPathTranslations(table, kPathTranslation, kAnyTargetSdk);
+  AddPathTranslations(table, kPathTranslationQ, __ANDROID_API_Q__);
+  AddPathTranslations(table, kPathTranslationN, __ANDROID_API_N__);
+  return table;
+}
+
+constexpr PathTranslationTable kPathTranslationTable = BuildPathTranslationTable();
+
+}  // namespace
+
 // Workaround for dlopen(/system/lib(64)/<soname>) when .so is in /apex. http://b/121248172
 /**
  * Translate /system path to /apex path if needed
@@ -40,79 +151,26 @@
  * return true if translation is needed
  */
 bool translateSystemPathToApexPath(const char* name, std::string* out_name_to_apex) {
-  static constexpr const char* kPathTranslation[][2] = {
-      SYSTEM_LIB("libEGL.so"),
-      SYSTEM_LIB("libGLESv1_CM.so"),
-      SYSTEM_LIB("libGLESv2.so"),
-      SYSTEM_LIB("libGLESv3.so"),
-      SYSTEM_LIB("libOpenMAXAL.so"),
-      SYSTEM_LIB("libOpenSLES.so"),
-      SYSTEM_LIB("libRS.so"),
-      SYSTEM_LIB("libaaudio.so"),
-      SYSTEM_LIB("libamidi.so"),
-      SYSTEM_LIB("libandroid.so"),
-      SYSTEM_LIB("libbinder_ndk.so"),
-      SYSTEM_LIB("libc.so"),
-      SYSTEM_LIB("libcamera2ndk.so"),
-      SYSTEM_LIB("libdl.so"),
-      SYSTEM_LIB("libjnigraphics.so"),
-      SYSTEM_LIB("liblog.so"),
-      SYSTEM_LIB("libm.so"),
-      SYSTEM_LIB("libmediandk.so"),
-      SYSTEM_LIB("libnativewindow.so"),
-      SYSTEM_LIB("libstdc++.so"),
-      SYSTEM_LIB("libsync.so"),
-      SYSTEM_LIB("libvulkan.so"),
-      SYSTEM_LIB("libwebviewchromium_plat_support.so"),
-      SYSTEM_LIB("libz.so")};
-
-  static constexpr const char* kPathTranslationQ[][2] = {
-      SYSTEM_LIB("libicui18n.so"), SYSTEM_LIB("libicuuc.so"), SYSTEM_LIB("libneuralnetworks.so")};
-
-  // Libraries from greylist.  Only convert these for apps targeting N or below.
-  static constexpr const char* kPathTranslationN[][2] = {SYSTEM_LIB("libandroid_runtime.so"),
-                                                         SYSTEM_LIB("libbinder.so"),
-                                                         SYSTEM_LIB("libcrypto.so"),
-                                                         SYSTEM_LIB("libcutils.so"),
-                                                         SYSTEM_LIB("libexpat.so"),
-                                                         SYSTEM_LIB("libgui.so"),
-                                                         SYSTEM_LIB("libmedia.so"),
-                                                         SYSTEM_LIB("libnativehelper.so"),
-                                                         SYSTEM_LIB("libssl.so"),
-                                                         SYSTEM_LIB("libstagefright.so"),
-                                                         SYSTEM_LIB("libsqlite.so"),
-                                                         SYSTEM_LIB("libui.so"),
-                                                         SYSTEM_LIB("libutils.so"),
-                                                         SYSTEM_LIB("libvorbisidec.so")};
-
   if (name == nullptr) {
     return false;
   }
 
-  auto comparator = [name](auto p) { return strcmp(name, p[0]) == 0; };
-
-  if (auto it = std::find_if(std::begin(kPathTranslation), std::end(kPathTranslation), comparator);
-      it != std::end(kPathTranslation)) {
-    *out_name_to_apex = (*it)[1];
-    return true;
-  }
-
-  if (get_application_target_sdk_version() < __ANDROID_API_Q__) {
-    if (auto it =
-            std::find_if(std::begin(kPathTranslationQ), std::end(kPathTranslationQ), comparator);
-        it != std::end(kPathTranslationQ)) {
-      *out_name_to_apex = (*it)[1];
-      return true;
+  const uint32_t hash = HashPath(name);
+  for (size_t slot = hash & (kPathTranslationSlots - 1);
+       kPathTranslationTable.slots[slot].translation != nullptr;
+       slot = (slot + 1) & (kPathTranslationSlots - 1)) {
+    const PathTranslationEntry& entry = kPathTranslationTable.slots[slot];
+    if (entry.hash != hash || strcmp(name, entry.translation[0]) != 0) {
+      continue;
     }
-  }
 
-  if (get_application_target_sdk_version() < __ANDROID_API_N__) {
-    if (auto it =
-            std::find_if(std::begin(kPathTranslationN), std::end(kPathTranslationN), comparator);
-        it != std::end(kPathTranslationN)) {
-      *out_name_to_apex = (*it)[1];
-      return true;
+    if (entry.target_sdk_limit != kAnyTargetSdk &&
+        get_application_target_sdk_version() >= entry.target_sdk_limit) {
+      return false;
     }
+
+    *out_name_to_apex = entry.translation[1];
+    return true;
   }
 
   return false;
@@ -33,16 +33,11 @@ NATIVE_BRIDGE_ORIG_GUEST_LIBS := \
     libcompiler_rt \
     libcrypto \
     libcutils \
-    libdl.bootstrap \
     libdl_android.bootstrap \
-    liblog \
-    libm.bootstrap \
-    libsqlite \
     libssl \
     libstdc++ \
     libsync \
-    libutils \
-    libz
+    libutils
 
 # TODO(b/141167717): hack to make libandroidicu compatible with APEX.
 #
@@ -89,6 +84,7 @@ NATIVE_BRIDGE_MODIFIED_GUEST_LIBS := \
     libbinder_ndk \
     libc \
     libcamera2ndk \
+    libdl \
     libEGL \
     libGLESv1_CM \
     libGLESv2 \
@@ -96,14 +92,18 @@ NATIVE_BRIDGE_MODIFIED_GUEST_LIBS := \
     libicui18n \
     libicuuc \
     libjnigraphics \
+    liblog \
+    libm \
     libmediandk \
     libnativehelper \
     libnativewindow \
     libneuralnetworks \
     libOpenMAXAL \
     libOpenSLES \
+    libsqlite \
     libvulkan \
-    libwebviewchromium_plat_support
+    libwebviewchromium_plat_support \
+    libz
 
 # Original guest libraries are built for native_bridge
 NATIVE_BRIDGE_PRODUCT_PACKAGES += \
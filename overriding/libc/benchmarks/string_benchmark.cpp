@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+// Measures the guest libc's memory functions across sizes and alignments, to
+// find where handing them to the host gets cheaper than running them in the
+// guest.
+//
+// Run the guest build of this benchmark against the guest libc as built, which
+// uses bionic's routines for every size, and against one built with
+// NATIVE_BRIDGE_HOST_STRING_FUNCTIONS_THRESHOLD=0, which uses the host for
+// every size. The threshold is the size from which the second run is faster.
+
+namespace {
+
+// Buffers start this far past a cache line boundary.
+constexpr int kOffsets[] = {0, 1, 7};
+
+constexpr size_t kCacheLineSize = 64;
+
+// Sizes around the threshold, plus a few large ones, each at every offset.
+void SizesAndOffsets(benchmark::internal::Benchmark* b) {
+  for (int size : {8, 16, 32, 64, 96, 128, 192, 256, 384, 512, 1024, 4096, 65536}) {
+    for (int offset : kOffsets) {
+      b->Args({size, offset});
+    }
+  }
+}
+
+// Memory for a buffer of the benchmark's size at the benchmark's offset.
+class Buffer {
+ public:
+  Buffer(const benchmark::State& state, char fill)
+      : storage_(state.range(0) + kCacheLineSize + state.range(1), fill) {
+    uintptr_t start = reinterpret_cast<uintptr_t>(storage_.data());
+    uintptr_t aligned = (start + kCacheLineSize - 1) & ~(kCacheLineSize - 1);
+    data_ = storage_.data() + (aligned - start) + state.range(1);
+  }
+
+  char* data() { return data_; }
+
+ private:
+  std::vector<char> storage_;
+  char* data_;
+};
+
+void BM_memcpy(benchmark::State& state) {
+  size_t size = state.range(0);
+  Buffer src(state, 'x');
+  Buffer dst(state, 0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(memcpy(dst.data(), src.data(), size));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_memcpy)->Apply(SizesAndOffsets);
+
+// Source and destination one byte apart, on top of the offset.
+void BM_memmove_overlapping(benchmark::State& state) {
+  size_t size = state.range(0);
+  Buffer buf(state, 'x');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(memmove(buf.data(), buf.data() + 1, size - 1));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * (size - 1));
+}
+BENCHMARK(BM_memmove_overlapping)->Apply(SizesAndOffsets);
+
+void BM_memset(benchmark::State& state) {
+  size_t size = state.range(0);
+  Buffer dst(state, 0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(memset(dst.data(), 'x', size));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_memset)->Apply(SizesAndOffsets);
+
+// Equal buffers, so that every byte is compared.
+void BM_memcmp(benchmark::State& state) {
+  size_t size = state.range(0);
+  Buffer lhs(state, 'x');
+  Buffer rhs(state, 'x');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(memcmp(lhs.data(), rhs.data(), size));
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_memcmp)->Apply(SizesAndOffsets);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Bulk memory functions run much faster on the host than translated, but each
+// host call costs a guest/host transition. Leave small sizes to bionic's own
+// routines and hand larger ones to the host.
+//
+// This needs native_bridge_memcpy() and friends on the host, so it is only
+// built when NATIVE_BRIDGE_HOST_STRING_FUNCTIONS_THRESHOLD is defined, to the
+// size from which the host call is cheaper. Measure it for the target with
+// benchmarks/string_benchmark.cpp.
+//
+// memchr() stays with bionic: its size is only an upper bound, and the match
+// is usually found long before it.
+
+#if defined(NATIVE_BRIDGE_HOST_STRING_FUNCTIONS_THRESHOLD)
+
+#include <stddef.h>
+#include <string.h>
+
+#include <atomic>
+
+#if !defined(__aarch64__)
+#error Only arm64 routes memory functions to the host.
+#endif
+
+// bionic's routines. These definitions replace the memcpy() etc. that bionic
+// dispatches to them, the same way stubs_*.cpp replace bionic functions with
+// host ones (see -z muldefs in Android.bp).
+extern "C" int __memcmp_aarch64(const void*, const void*, size_t);
+extern "C" void* __memcpy_aarch64(void*, const void*, size_t);
+extern "C" void* __memmove_aarch64(void*, const void*, size_t);
+extern "C" void* __memset_aarch64(void*, int, size_t);
+
+extern "C" int native_bridge_memcmp(const void*, const void*, size_t);
+extern "C" void* native_bridge_memcpy(void*, const void*, size_t);
+extern "C" void* native_bridge_memmove(void*, const void*, size_t);
+extern "C" void* native_bridge_memset(void*, int, size_t);
+
+namespace {
+
+constexpr size_t kHostThreshold = NATIVE_BRIDGE_HOST_STRING_FUNCTIONS_THRESHOLD;
+
+// libc copies memory before its constructors run, so stay with bionic until
+// stubs_arm64.cpp has registered the host functions.
+std::atomic<bool> g_host_functions_registered;
+
+bool UseHost(size_t n) {
+  return n >= kHostThreshold && g_host_functions_registered.load(std::memory_order_relaxed);
+}
+
+// Runs after init_stub_library(), which has priority 0.
+__attribute__((constructor(1))) void EnableHostStringFunctions() {
+  g_host_functions_registered.store(true, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+int memcmp(const void* lhs, const void* rhs, size_t n) {
+  return UseHost(n) ? native_bridge_memcmp(lhs, rhs, n) : __memcmp_aarch64(lhs, rhs, n);
+}
+
+void* memcpy(void* __restrict dst, const void* __restrict src, size_t n) {
+  return UseHost(n) ? native_bridge_memcpy(dst, src, n) : __memcpy_aarch64(dst, src, n);
+}
+
+void* memmove(void* dst, const void* src, size_t n) {
+  return UseHost(n) ? native_bridge_memmove(dst, src, n) : __memmove_aarch64(dst, src, n);
+}
+
+void* memset(void* dst, int c, size_t n) {
+  return UseHost(n) ? native_bridge_memset(dst, c, n) : __memset_aarch64(dst, c, n);
+}
+
+#endif  // defined(NATIVE_BRIDGE_HOST_STRING_FUNCTIONS_THRESHOLD)
@@ -61,6 +61,12 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_malloc_iterate);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_malloc_usable_size);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_mallopt);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_memalign);
+#if defined(NATIVE_BRIDGE_HOST_STRING_FUNCTIONS_THRESHOLD)
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_memcmp);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_memcpy);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_memmove);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_memset);
+#endif
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_posix_memalign);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_realloc);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(pthread_attr_destroy);
@@ -149,6 +155,12 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_malloc_usable_size);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_mallopt);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_memalign);
+#if defined(NATIVE_BRIDGE_HOST_STRING_FUNCTIONS_THRESHOLD)
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_memcmp);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_memcpy);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_memmove);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_memset);
+#endif
   INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_posix_memalign);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", native_bridge_realloc);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libc.so", pthread_attr_destroy);
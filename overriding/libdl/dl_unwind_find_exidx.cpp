@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <private/bionic_globals.h>
+
+#include <link.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+// Unwinders call dl_unwind_find_exidx() for every frame they unwind: the
+// libunwind linked into the guest libc, and the NDK's libunwind and libgcc
+// linked into applications. They all get it from libdl. The linker answers it
+// under its global lock by walking all loaded libraries and their program
+// headers, which is slow when translated. Keep a sorted table of PT_LOAD
+// segments with their PT_ARM_EXIDX instead, maintained from the linker's load
+// and unload hooks. These see every load, including the app libraries that
+// native bridge loads through the linker directly.
+//
+// libdl doesn't link libc, so the table is static and entries are moved by
+// hand (see -fno-builtin in Android.bp).
+
+extern "C" libc_shared_globals* __loader_shared_globals();
+extern "C" _Unwind_Ptr __loader_dl_unwind_find_exidx(_Unwind_Ptr pc, int* pcount);
+
+namespace {
+
+struct ExidxRange {
+  ElfW(Addr) start;
+  ElfW(Addr) end;
+  _Unwind_Ptr exidx;
+  int count;
+};
+
+constexpr size_t kMaxRanges = 4096;
+
+// The table is only changed with the linker's global lock held: from its load
+// and unload hooks, and from a dl_iterate_phdr() callback at startup. Lookups
+// take no lock. They read g_generation before and after searching, and give
+// up if a change was in progress or happened in between. A lookup never
+// blocks or allocates, so unwinding from a signal handler is safe.
+ExidxRange g_ranges[kMaxRanges];
+size_t g_ranges_size;
+// Odd while the table is being changed.
+std::atomic<uint32_t> g_generation;
+// Cleared for good if the table overflows.
+std::atomic<bool> g_table_valid;
+
+void BeginUpdate() {
+  g_generation.store(g_generation.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void EndUpdate() {
+  g_generation.store(g_generation.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+// Returns the index of the first range starting above addr.
+size_t UpperBound(ElfW(Addr) addr) {
+  size_t lo = 0;
+  size_t hi = g_ranges_size;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (g_ranges[mid].start <= addr) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+void InsertRange(size_t pos, const ExidxRange& range) {
+  for (size_t i = g_ranges_size; i > pos; --i) {
+    g_ranges[i] = g_ranges[i - 1];
+  }
+  g_ranges[pos] = range;
+  ++g_ranges_size;
+}
+
+void EraseRange(size_t pos) {
+  --g_ranges_size;
+  for (size_t i = pos; i < g_ranges_size; ++i) {
+    g_ranges[i] = g_ranges[i + 1];
+  }
+}
+
+void AddObject(ElfW(Addr) base, const ElfW(Phdr)* phdr, ElfW(Half) phnum) {
+  _Unwind_Ptr exidx = 0;
+  int count = 0;
+  for (ElfW(Half) i = 0; i < phnum; ++i) {
+    if (phdr[i].p_type == PT_ARM_EXIDX) {
+      exidx = base + phdr[i].p_vaddr;
+      count = phdr[i].p_memsz / 8;
+    }
+  }
+
+  BeginUpdate();
+  for (ElfW(Half) i = 0; i < phnum && g_table_valid.load(std::memory_order_relaxed); ++i) {
+    if (phdr[i].p_type != PT_LOAD) {
+      continue;
+    }
+    ElfW(Addr) start = base + phdr[i].p_vaddr;
+    size_t pos = UpperBound(start);
+    if (pos > 0 && g_ranges[pos - 1].start == start) {
+      // Already added by the startup scan.
+      continue;
+    }
+    if (g_ranges_size == kMaxRanges) {
+      g_table_valid.store(false, std::memory_order_relaxed);
+      break;
+    }
+    InsertRange(pos, {start, start + phdr[i].p_memsz, exidx, count});
+  }
+  EndUpdate();
+}
+
+void RemoveObject(ElfW(Addr) base, const ElfW(Phdr)* phdr, ElfW(Half) phnum) {
+  BeginUpdate();
+  for (ElfW(Half) i = 0; i < phnum; ++i) {
+    if (phdr[i].p_type != PT_LOAD) {
+      continue;
+    }
+    ElfW(Addr) start = base + phdr[i].p_vaddr;
+    size_t pos = UpperBound(start);
+    if (pos > 0 && g_ranges[pos - 1].start == start) {
+      EraseRange(pos - 1);
+    }
+  }
+  EndUpdate();
+}
+
+int AddLoadedObject(dl_phdr_info* info, size_t, void*) {
+  AddObject(info->dlpi_addr, info->dlpi_phdr, info->dlpi_phnum);
+  return 0;
+}
+
+bool LookupExidx(_Unwind_Ptr pc, _Unwind_Ptr* exidx, int* pcount) {
+  if (!g_table_valid.load(std::memory_order_acquire)) {
+    return false;
+  }
+  uint32_t generation = g_generation.load(std::memory_order_acquire);
+  if ((generation & 1) != 0) {
+    return false;
+  }
+  bool found = false;
+  size_t pos = UpperBound(pc);
+  if (pos > 0 && pc < g_ranges[pos - 1].end) {
+    *exidx = g_ranges[pos - 1].exidx;
+    *pcount = g_ranges[pos - 1].count;
+    found = true;
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  // Unknown addresses are left to the linker too.
+  return found && g_generation.load(std::memory_order_relaxed) == generation;
+}
+
+__attribute__((constructor)) void InitExidxTable() {
+  libc_shared_globals* globals = __loader_shared_globals();
+  if (globals->load_hook != nullptr || globals->unload_hook != nullptr) {
+    // Someone else tracks loads already, keep asking the linker.
+    return;
+  }
+  g_table_valid.store(true, std::memory_order_release);
+
+  // Install the hooks before the scan so that no load is missed. Objects seen
+  // by both are only added once.
+  globals->load_hook = AddObject;
+  globals->unload_hook = RemoveObject;
+  dl_iterate_phdr(AddLoadedObject, nullptr);
+}
+
+}  // namespace
+
+_Unwind_Ptr dl_unwind_find_exidx(_Unwind_Ptr pc, int* pcount) {
+  _Unwind_Ptr exidx;
+  if (LookupExidx(pc, &exidx, pcount)) {
+    return exidx;
+  }
+  return __loader_dl_unwind_find_exidx(pc, pcount);
+}
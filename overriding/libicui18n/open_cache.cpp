@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pthread.h>
+#include <string.h>
+
+#include "unicode/ucal.h"
+#include "unicode/ucol.h"
+#include "unicode/udat.h"
+#include "unicode/uloc.h"
+#include "unicode/unum.h"
+#include "unicode/ustring.h"
+#include "unicode/utypes.h"
+
+// Opening a collator or formatter loads and parses locale data on the host,
+// and code often opens a new one for every string it formats or compares.
+// Keep the first object opened for each set of arguments as a prototype and
+// hand out clones of it instead. Cloning is a const operation, which ICU
+// allows on the same object from several threads, and each caller still owns
+// and closes its own object.
+//
+// Only opens that depend on nothing but their arguments, the default locale
+// and the default time zone are cached. Patterns and custom rules are passed
+// to the host every time.
+
+extern "C" UCollator* native_bridge_host_ucol_open(const char* loc, UErrorCode* status);
+extern "C" UDateFormat* native_bridge_host_udat_open(UDateFormatStyle timeStyle,
+                                                     UDateFormatStyle dateStyle, const char* locale,
+                                                     const UChar* tzID, int32_t tzIDLength,
+                                                     const UChar* pattern, int32_t patternLength,
+                                                     UErrorCode* status);
+extern "C" UNumberFormat* native_bridge_host_unum_open(UNumberFormatStyle style,
+                                                       const UChar* pattern, int32_t patternLength,
+                                                       const char* locale, UParseError* parseErr,
+                                                       UErrorCode* status);
+
+namespace {
+
+enum PrototypeType {
+  kCollator = 1,
+  kDateFormat,
+  kNumberFormat,
+};
+
+// Longest time zone ID cached, in UTF-16 code units.
+constexpr int32_t kMaxTimeZoneIdLength = 64;
+
+constexpr size_t kMaxPrototypes = 16;
+
+struct PrototypeKey {
+  PrototypeType type;
+  int32_t style;
+  int32_t date_style;
+  char locale[ULOC_FULLNAME_CAPACITY];
+  UChar time_zone_id[kMaxTimeZoneIdLength];
+};
+
+struct Prototype {
+  PrototypeKey key;
+  void* object;
+  // Warning the host set when opening the prototype, such as
+  // U_USING_FALLBACK_WARNING, returned again with each clone.
+  UErrorCode warning;
+};
+
+pthread_mutex_t g_prototypes_lock = PTHREAD_MUTEX_INITIALIZER;
+Prototype g_prototypes[kMaxPrototypes];
+size_t g_prototypes_size;
+
+// Returns false if the key can't be built, in which case the open isn't
+// cached.
+bool InitKey(PrototypeKey* key, PrototypeType type, int32_t style, int32_t date_style,
+             const char* locale) {
+  key->type = type;
+  key->style = style;
+  key->date_style = date_style;
+  key->time_zone_id[0] = 0;
+  if (locale == nullptr) {
+    locale = uloc_getDefault();
+  }
+  size_t length = strlen(locale);
+  if (length >= sizeof(key->locale)) {
+    return false;
+  }
+  memcpy(key->locale, locale, length + 1);
+  return true;
+}
+
+bool SetTimeZoneId(PrototypeKey* key, const UChar* tz_id, int32_t tz_id_length) {
+  if (tz_id == nullptr) {
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t length =
+        ucal_getDefaultTimeZone(key->time_zone_id, kMaxTimeZoneIdLength, &status);
+    // The ID must fit with its terminating zero.
+    return U_SUCCESS(status) && length < kMaxTimeZoneIdLength;
+  }
+  if (tz_id_length < 0) {
+    tz_id_length = u_strlen(tz_id);
+  }
+  if (tz_id_length >= kMaxTimeZoneIdLength) {
+    return false;
+  }
+  memcpy(key->time_zone_id, tz_id, tz_id_length * sizeof(UChar));
+  key->time_zone_id[tz_id_length] = 0;
+  return true;
+}
+
+bool KeysEqual(const PrototypeKey& lhs, const PrototypeKey& rhs) {
+  return lhs.type == rhs.type && lhs.style == rhs.style && lhs.date_style == rhs.date_style &&
+         strcmp(lhs.locale, rhs.locale) == 0 && u_strcmp(lhs.time_zone_id, rhs.time_zone_id) == 0;
+}
+
+bool FindPrototype(const PrototypeKey& key, Prototype* result) {
+  bool found = false;
+  pthread_mutex_lock(&g_prototypes_lock);
+  for (size_t i = 0; i < g_prototypes_size; ++i) {
+    if (KeysEqual(g_prototypes[i].key, key)) {
+      *result = g_prototypes[i];
+      found = true;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&g_prototypes_lock);
+  return found;
+}
+
+// Returns false if the prototype wasn't kept, because the cache is full or
+// another thread added one for the same key first. The caller then still owns
+// the object.
+bool AddPrototype(const Prototype& prototype) {
+  bool added = false;
+  pthread_mutex_lock(&g_prototypes_lock);
+  if (g_prototypes_size < kMaxPrototypes) {
+    added = true;
+    for (size_t i = 0; i < g_prototypes_size; ++i) {
+      if (KeysEqual(g_prototypes[i].key, prototype.key)) {
+        added = false;
+        break;
+      }
+    }
+    if (added) {
+      g_prototypes[g_prototypes_size++] = prototype;
+    }
+  }
+  pthread_mutex_unlock(&g_prototypes_lock);
+  return added;
+}
+
+// Opens with open() and clones with clone(), going through the prototype for
+// key. close() releases an object that couldn't be kept as a prototype.
+template <typename T, typename Open, typename Clone, typename Close>
+T* OpenCached(const PrototypeKey& key, UErrorCode* status, Open open, Clone clone, Close close) {
+  Prototype prototype;
+  if (!FindPrototype(key, &prototype)) {
+    prototype.key = key;
+    prototype.warning = U_ZERO_ERROR;
+    T* object = open(&prototype.warning);
+    if (U_FAILURE(prototype.warning)) {
+      *status = prototype.warning;
+      return nullptr;
+    }
+    prototype.object = object;
+    if (!AddPrototype(prototype)) {
+      Prototype cached;
+      if (!FindPrototype(key, &cached)) {
+        // The cache is full, so hand out the object itself.
+        if (prototype.warning != U_ZERO_ERROR) {
+          *status = prototype.warning;
+        }
+        return object;
+      }
+      close(object);
+      prototype = cached;
+    }
+  }
+
+  UErrorCode open_status = prototype.warning != U_ZERO_ERROR ? prototype.warning : *status;
+  T* object = clone(static_cast<const T*>(prototype.object), status);
+  if (U_SUCCESS(*status)) {
+    // Report what the open would have, not warnings from the clone such as
+    // U_SAFECLONE_ALLOCATED_WARNING.
+    *status = open_status;
+  }
+  return object;
+}
+
+}  // namespace
+
+U_CAPI UCollator* U_EXPORT2 ucol_open(const char* loc, UErrorCode* status) {
+  PrototypeKey key;
+  if (status == nullptr || U_FAILURE(*status) || !InitKey(&key, kCollator, 0, 0, loc)) {
+    return native_bridge_host_ucol_open(loc, status);
+  }
+  return OpenCached<UCollator>(
+      key, status, [loc](UErrorCode* open_status) {
+        return native_bridge_host_ucol_open(loc, open_status);
+      },
+      [](const UCollator* prototype, UErrorCode* clone_status) {
+        return ucol_safeClone(prototype, nullptr, nullptr, clone_status);
+      },
+      ucol_close);
+}
+
+U_CAPI UDateFormat* U_EXPORT2 udat_open(UDateFormatStyle timeStyle, UDateFormatStyle dateStyle,
+                                        const char* locale, const UChar* tzID, int32_t tzIDLength,
+                                        const UChar* pattern, int32_t patternLength,
+                                        UErrorCode* status) {
+  PrototypeKey key;
+  if (status == nullptr || U_FAILURE(*status) || pattern != nullptr ||
+      timeStyle == UDAT_PATTERN || dateStyle == UDAT_PATTERN ||
+      !InitKey(&key, kDateFormat, timeStyle, dateStyle, locale) ||
+      !SetTimeZoneId(&key, tzID, tzIDLength)) {
+    return native_bridge_host_udat_open(timeStyle, dateStyle, locale, tzID, tzIDLength, pattern,
+                                        patternLength, status);
+  }
+  return OpenCached<UDateFormat>(
+      key, status, [&](UErrorCode* open_status) {
+        return native_bridge_host_udat_open(timeStyle, dateStyle, locale, tzID, tzIDLength,
+                                            pattern, patternLength, open_status);
+      },
+      udat_clone, udat_close);
+}
+
+U_CAPI UNumberFormat* U_EXPORT2 unum_open(UNumberFormatStyle style, const UChar* pattern,
+                                          int32_t patternLength, const char* locale,
+                                          UParseError* parseErr, UErrorCode* status) {
+  PrototypeKey key;
+  if (status == nullptr || U_FAILURE(*status) || pattern != nullptr ||
+      style == UNUM_PATTERN_DECIMAL || style == UNUM_PATTERN_RULEBASED ||
+      !InitKey(&key, kNumberFormat, style, 0, locale)) {
+    return native_bridge_host_unum_open(style, pattern, patternLength, locale, parseErr, status);
+  }
+  return OpenCached<UNumberFormat>(
+      key, status, [&](UErrorCode* open_status) {
+        return native_bridge_host_unum_open(style, pattern, patternLength, locale, parseErr,
+                                            open_status);
+      },
+      unum_clone, unum_close);
+}
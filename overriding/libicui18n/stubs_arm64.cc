@@ -3885,6 +3885,9 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(izrule_getRawOffset_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(izrule_getStaticClassID_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(izrule_isEquivalentTo_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(izrule_open_66);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_ucol_open);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_udat_open);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_unum_open);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_formatMessageWithError_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_formatMessage_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_parseMessageWithError_66);
@@ -3996,7 +3999,6 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(ucol_openBinary_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(ucol_openElements_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(ucol_openFromShortString_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(ucol_openRules_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(ucol_open_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(ucol_prepareShortStringOpen_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(ucol_previous_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(ucol_primaryOrder_66);
@@ -4052,7 +4054,6 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(udat_getNumberFormatForField_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(udat_getNumberFormat_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(udat_getSymbols_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(udat_isLenient_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(udat_open_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(udat_parseCalendar_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(udat_parse_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(udat_registerOpener_66);
@@ -4170,7 +4171,6 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(unum_getDoubleAttribute_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(unum_getLocaleByType_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(unum_getSymbol_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(unum_getTextAttribute_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(unum_open_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(unum_parseDecimal_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(unum_parseDoubleCurrency_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(unum_parseDouble_66);
@@ -8376,6 +8376,9 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", izrule_getStaticClassID_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", izrule_isEquivalentTo_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", izrule_open_66);
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libicui18n.so", native_bridge_host_ucol_open, "ucol_open_66");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libicui18n.so", native_bridge_host_udat_open, "udat_open_66");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libicui18n.so", native_bridge_host_unum_open, "unum_open_66");
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", u_formatMessageWithError_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", u_formatMessage_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", u_parseMessageWithError_66);
@@ -8487,7 +8490,6 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", ucol_openElements_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", ucol_openFromShortString_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", ucol_openRules_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", ucol_open_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", ucol_prepareShortStringOpen_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", ucol_previous_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", ucol_primaryOrder_66);
@@ -8543,7 +8545,6 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", udat_getNumberFormat_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", udat_getSymbols_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", udat_isLenient_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", udat_open_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", udat_parseCalendar_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", udat_parse_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", udat_registerOpener_66);
@@ -8661,7 +8662,6 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", unum_getLocaleByType_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", unum_getSymbol_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", unum_getTextAttribute_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", unum_open_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", unum_parseDecimal_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", unum_parseDoubleCurrency_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicui18n.so", unum_parseDouble_66);
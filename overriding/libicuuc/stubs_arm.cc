@@ -1444,6 +1444,8 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(_ZThn4_NK6icu_6610UnicodeSet13addMatchSetToER
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(_ZThn4_NK6icu_6610UnicodeSet17matchesIndexValueEh);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(_ZThn4_NK6icu_6610UnicodeSet9toPatternERNS_13UnicodeStringEa);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(locale_getKeywordsStart_66);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_u_strFromUTF8);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(native_bridge_host_u_strToUTF8);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(res_countArrayItems_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(res_getAlias_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(res_getArrayItem_66);
@@ -1463,16 +1465,13 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_catclose_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_catgets_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_catopen_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_charAge_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_charDigitValue_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_charDirection_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_charFromName_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_charMirror_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_charName_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_charType_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_charsToUChars_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_cleanup_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_countChar32_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_digit_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_enumCharNames_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_enumCharTypes_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_errorName_66);
@@ -1501,34 +1500,11 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_getUnicodeVersion_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_getVersion_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_hasBinaryProperty_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_init_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isIDIgnorable_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isIDPart_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isIDStart_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isISOControl_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isJavaIDPart_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isJavaIDStart_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isJavaSpaceChar_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isMirrored_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isUAlphabetic_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isULowercase_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isUUppercase_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isUWhiteSpace_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isWhitespace_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isalnum_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isalpha_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isbase_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isblank_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_iscntrl_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isdefined_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isdigit_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isgraph_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_islower_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isprint_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_ispunct_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isspace_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_istitle_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isupper_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_isxdigit_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_memcasecmp_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_memchr32_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_memchr_66);
@@ -1557,7 +1533,6 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strFromUTF32WithSub_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strFromUTF32_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strFromUTF8Lenient_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strFromUTF8WithSub_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strFromUTF8_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strFromWCS_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strHasMoreChar32Than_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strToJavaModifiedUTF8_66);
@@ -1566,7 +1541,6 @@ DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strToTitle_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strToUTF32WithSub_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strToUTF32_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strToUTF8WithSub_66);
-DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strToUTF8_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strToUpper_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strToWCS_66);
 DEFINE_INTERCEPTABLE_STUB_FUNCTION(u_strcasecmp_66);
@@ -3757,6 +3731,8 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", _ZThn4_NK6icu_6610UnicodeSet17matchesIndexValueEh);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", _ZThn4_NK6icu_6610UnicodeSet9toPatternERNS_13UnicodeStringEa);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", locale_getKeywordsStart_66);
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libicuuc.so", native_bridge_host_u_strFromUTF8, "u_strFromUTF8_66");
+  INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME("libicuuc.so", native_bridge_host_u_strToUTF8, "u_strToUTF8_66");
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", res_countArrayItems_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", res_getAlias_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", res_getArrayItem_66);
@@ -3776,16 +3752,13 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_catgets_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_catopen_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_charAge_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_charDigitValue_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_charDirection_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_charFromName_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_charMirror_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_charName_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_charType_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_charsToUChars_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_cleanup_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_countChar32_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_digit_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_enumCharNames_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_enumCharTypes_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_errorName_66);
@@ -3814,34 +3787,11 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_getVersion_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_hasBinaryProperty_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_init_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isIDIgnorable_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isIDPart_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isIDStart_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isISOControl_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isJavaIDPart_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isJavaIDStart_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isJavaSpaceChar_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isMirrored_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isUAlphabetic_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isULowercase_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isUUppercase_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isUWhiteSpace_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isWhitespace_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isalnum_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isalpha_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isbase_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isblank_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_iscntrl_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isdefined_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isdigit_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isgraph_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_islower_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isprint_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_ispunct_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isspace_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_istitle_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isupper_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_isxdigit_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_memcasecmp_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_memchr32_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_memchr_66);
@@ -3870,7 +3820,6 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strFromUTF32_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strFromUTF8Lenient_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strFromUTF8WithSub_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strFromUTF8_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strFromWCS_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strHasMoreChar32Than_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strToJavaModifiedUTF8_66);
@@ -3879,7 +3828,6 @@ static void __attribute__((constructor(0))) init_stub_library() {
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strToUTF32WithSub_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strToUTF32_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strToUTF8WithSub_66);
-  INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strToUTF8_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strToUpper_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strToWCS_66);
   INIT_INTERCEPTABLE_STUB_FUNCTION("libicuuc.so", u_strcasecmp_66);
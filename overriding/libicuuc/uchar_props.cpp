@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "unicode/uchar.h"
+#include "unicode/utypes.h"
+
+#include "uprops.h"
+#include "utrie2.h"
+
+// Character classification is called once per code point, so a host call for
+// each costs far more than the lookup itself. The general category and numeric
+// type trie is compiled into ICU rather than loaded from icudt, so compile the
+// same data into the guest library and answer these in the guest, the same way
+// ICU's uchar.cpp does. Everything else in libicuuc is still the host's.
+
+#define INCLUDED_FROM_UCHAR_C
+#include "uchar_props_data.h"
+
+namespace {
+
+constexpr UChar32 kTab = 0x0009;
+constexpr UChar32 kCr = 0x000d;
+constexpr UChar32 kNbsp = 0x00a0;
+constexpr UChar32 kFigureSp = 0x2007;
+constexpr UChar32 kNnbsp = 0x202f;
+
+inline uint32_t GetProps(UChar32 c) {
+  return UTRIE2_GET16(&propsTrie, c);
+}
+
+inline int8_t GetCategory(UChar32 c) {
+  return static_cast<int8_t>(GetProps(c) & 0x1f);
+}
+
+inline uint32_t GetCategoryMask(UChar32 c) {
+  return U_MASK(GetCategory(c));
+}
+
+// TAB..CR, FS..US and NEL.
+inline bool IsControlSpace(UChar32 c) {
+  return c <= 0x9f && ((c >= kTab && c <= kCr) || (c >= 0x1c && c <= 0x1f) || c == 0x85);
+}
+
+// TAB..CR and FS..US.
+inline bool IsAsciiControlSpace(UChar32 c) {
+  return c <= 0x1f && c >= kTab && (c <= kCr || c >= 0x1c);
+}
+
+}  // namespace
+
+U_CAPI int8_t U_EXPORT2 u_charType(UChar32 c) {
+  return GetCategory(c);
+}
+
+U_CAPI UBool U_EXPORT2 u_islower(UChar32 c) {
+  return GetCategory(c) == U_LOWERCASE_LETTER;
+}
+
+U_CAPI UBool U_EXPORT2 u_isupper(UChar32 c) {
+  return GetCategory(c) == U_UPPERCASE_LETTER;
+}
+
+U_CAPI UBool U_EXPORT2 u_istitle(UChar32 c) {
+  return GetCategory(c) == U_TITLECASE_LETTER;
+}
+
+U_CAPI UBool U_EXPORT2 u_isdigit(UChar32 c) {
+  return GetCategory(c) == U_DECIMAL_DIGIT_NUMBER;
+}
+
+U_CAPI UBool U_EXPORT2 u_isxdigit(UChar32 c) {
+  // ASCII and fullwidth ASCII a-f and A-F.
+  if ((c <= 0x66 && c >= 0x41 && (c <= 0x46 || c >= 0x61)) ||
+      (c >= 0xff21 && c <= 0xff46 && (c <= 0xff26 || c >= 0xff41))) {
+    return true;
+  }
+  return GetCategory(c) == U_DECIMAL_DIGIT_NUMBER;
+}
+
+U_CAPI UBool U_EXPORT2 u_isalpha(UChar32 c) {
+  return (GetCategoryMask(c) & U_GC_L_MASK) != 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_isalnum(UChar32 c) {
+  return (GetCategoryMask(c) & (U_GC_L_MASK | U_GC_ND_MASK)) != 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_isdefined(UChar32 c) {
+  return GetCategory(c) != U_UNASSIGNED;
+}
+
+U_CAPI UBool U_EXPORT2 u_isbase(UChar32 c) {
+  return (GetCategoryMask(c) & (U_GC_L_MASK | U_GC_N_MASK | U_GC_MC_MASK | U_GC_ME_MASK)) != 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_iscntrl(UChar32 c) {
+  return (GetCategoryMask(c) & (U_GC_CC_MASK | U_GC_CF_MASK | U_GC_ZL_MASK | U_GC_ZP_MASK)) != 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_isISOControl(UChar32 c) {
+  return static_cast<uint32_t>(c) <= 0x9f && (c <= 0x1f || c >= 0x7f);
+}
+
+U_CAPI UBool U_EXPORT2 u_isspace(UChar32 c) {
+  return (GetCategoryMask(c) & U_GC_Z_MASK) != 0 || IsControlSpace(c);
+}
+
+U_CAPI UBool U_EXPORT2 u_isJavaSpaceChar(UChar32 c) {
+  return (GetCategoryMask(c) & U_GC_Z_MASK) != 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_isWhitespace(UChar32 c) {
+  // Spaces except the no-break ones, and the ASCII control spaces.
+  return ((GetCategoryMask(c) & U_GC_Z_MASK) != 0 && c != kNbsp && c != kFigureSp &&
+          c != kNnbsp) ||
+         IsAsciiControlSpace(c);
+}
+
+U_CAPI UBool U_EXPORT2 u_isblank(UChar32 c) {
+  if (static_cast<uint32_t>(c) <= 0x9f) {
+    return c == kTab || c == 0x20;
+  }
+  return GetCategory(c) == U_SPACE_SEPARATOR;
+}
+
+U_CAPI UBool U_EXPORT2 u_isprint(UChar32 c) {
+  return (GetCategoryMask(c) & U_GC_C_MASK) == 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_isgraph(UChar32 c) {
+  return (GetCategoryMask(c) &
+          (U_GC_CC_MASK | U_GC_CF_MASK | U_GC_CS_MASK | U_GC_CN_MASK | U_GC_Z_MASK)) == 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_ispunct(UChar32 c) {
+  return (GetCategoryMask(c) & U_GC_P_MASK) != 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_isIDIgnorable(UChar32 c) {
+  if (c <= 0x9f) {
+    return u_isISOControl(c) && !IsAsciiControlSpace(c);
+  }
+  return GetCategory(c) == U_FORMAT_CHAR;
+}
+
+U_CAPI UBool U_EXPORT2 u_isIDStart(UChar32 c) {
+  return (GetCategoryMask(c) & (U_GC_L_MASK | U_GC_NL_MASK)) != 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_isIDPart(UChar32 c) {
+  return (GetCategoryMask(c) & (U_GC_ND_MASK | U_GC_NL_MASK | U_GC_L_MASK | U_GC_PC_MASK |
+                                U_GC_MC_MASK | U_GC_MN_MASK)) != 0 ||
+         u_isIDIgnorable(c);
+}
+
+U_CAPI UBool U_EXPORT2 u_isJavaIDStart(UChar32 c) {
+  return (GetCategoryMask(c) & (U_GC_L_MASK | U_GC_SC_MASK | U_GC_PC_MASK)) != 0;
+}
+
+U_CAPI UBool U_EXPORT2 u_isJavaIDPart(UChar32 c) {
+  return (GetCategoryMask(c) & (U_GC_ND_MASK | U_GC_NL_MASK | U_GC_L_MASK | U_GC_SC_MASK |
+                                U_GC_PC_MASK | U_GC_MC_MASK | U_GC_MN_MASK)) != 0 ||
+         u_isIDIgnorable(c);
+}
+
+U_CAPI int32_t U_EXPORT2 u_charDigitValue(UChar32 c) {
+  int32_t value =
+      static_cast<int32_t>(GetProps(c) >> UPROPS_NUMERIC_TYPE_VALUE_SHIFT) - UPROPS_NTV_DECIMAL_START;
+  return value <= 9 ? value : -1;
+}
+
+U_CAPI int32_t U_EXPORT2 u_digit(UChar32 ch, int8_t radix) {
+  if (static_cast<uint8_t>(radix - 2) > 36 - 2) {
+    return -1;
+  }
+  int8_t value = static_cast<int8_t>(u_charDigitValue(ch));
+  if (value < 0) {
+    // Not a decimal digit, try ASCII and fullwidth ASCII letters.
+    if (ch >= 0x61 && ch <= 0x7a) {
+      value = static_cast<int8_t>(ch - 0x57);
+    } else if (ch >= 0x41 && ch <= 0x5a) {
+      value = static_cast<int8_t>(ch - 0x37);
+    } else if (ch >= 0xff41 && ch <= 0xff5a) {
+      value = static_cast<int8_t>(ch - 0xff37);
+    } else if (ch >= 0xff21 && ch <= 0xff3a) {
+      value = static_cast<int8_t>(ch - 0xff17);
+    }
+  }
+  return value < radix ? value : -1;
+}
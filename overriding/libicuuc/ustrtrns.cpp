@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <type_traits>
+
+#include "unicode/ustring.h"
+#include "unicode/utypes.h"
+
+// Most strings converted between UTF-16 and UTF-8 are short and ASCII, and
+// converting those in the guest is cheaper than a host call. Anything else,
+// including every error case, goes to the host ICU.
+
+extern "C" char* native_bridge_host_u_strToUTF8(char* dest, int32_t destCapacity,
+                                                int32_t* pDestLength, const UChar* src,
+                                                int32_t srcLength, UErrorCode* pErrorCode);
+extern "C" UChar* native_bridge_host_u_strFromUTF8(UChar* dest, int32_t destCapacity,
+                                                   int32_t* pDestLength, const char* src,
+                                                   int32_t srcLength, UErrorCode* pErrorCode);
+
+namespace {
+
+// Longest string converted in the guest. Longer ones are cheaper on the host.
+constexpr int32_t kMaxGuestLength = 256;
+
+bool IsGuestConvertible(const void* dest, int32_t destCapacity, const void* src, int32_t srcLength,
+                        const UErrorCode* pErrorCode) {
+  return pErrorCode != nullptr && U_SUCCESS(*pErrorCode) && src != nullptr && srcLength >= -1 &&
+         srcLength <= kMaxGuestLength && destCapacity >= 0 &&
+         (dest != nullptr || destCapacity == 0);
+}
+
+// Returns the length of src, or -1 if it isn't short ASCII. Copies as much as
+// fits into dest.
+template <typename Src, typename Dest>
+int32_t CopyAscii(Dest* dest, int32_t destCapacity, const Src* src, int32_t srcLength) {
+  for (int32_t i = 0;; ++i) {
+    if (srcLength < 0 ? src[i] == 0 : i == srcLength) {
+      return i;
+    }
+    auto c = static_cast<std::make_unsigned_t<Src>>(src[i]);
+    if (c >= 0x80 || i == kMaxGuestLength) {
+      return -1;
+    }
+    if (i < destCapacity) {
+      dest[i] = static_cast<Dest>(c);
+    }
+  }
+}
+
+// Same as ICU's u_terminateChars().
+template <typename Dest>
+void Terminate(Dest* dest, int32_t destCapacity, int32_t length, int32_t* pDestLength,
+               UErrorCode* pErrorCode) {
+  if (pDestLength != nullptr) {
+    *pDestLength = length;
+  }
+  if (length < destCapacity) {
+    dest[length] = 0;
+    if (*pErrorCode == U_STRING_NOT_TERMINATED_WARNING) {
+      *pErrorCode = U_ZERO_ERROR;
+    }
+  } else if (length == destCapacity) {
+    *pErrorCode = U_STRING_NOT_TERMINATED_WARNING;
+  } else {
+    *pErrorCode = U_BUFFER_OVERFLOW_ERROR;
+  }
+}
+
+}  // namespace
+
+U_CAPI char* U_EXPORT2 u_strToUTF8(char* dest, int32_t destCapacity, int32_t* pDestLength,
+                                   const UChar* src, int32_t srcLength, UErrorCode* pErrorCode) {
+  if (IsGuestConvertible(dest, destCapacity, src, srcLength, pErrorCode)) {
+    int32_t length = CopyAscii(dest, destCapacity, src, srcLength);
+    if (length >= 0) {
+      Terminate(dest, destCapacity, length, pDestLength, pErrorCode);
+      return dest;
+    }
+  }
+  return native_bridge_host_u_strToUTF8(dest, destCapacity, pDestLength, src, srcLength,
+                                        pErrorCode);
+}
+
+U_CAPI UChar* U_EXPORT2 u_strFromUTF8(UChar* dest, int32_t destCapacity, int32_t* pDestLength,
+                                      const char* src, int32_t srcLength, UErrorCode* pErrorCode) {
+  if (IsGuestConvertible(dest, destCapacity, src, srcLength, pErrorCode)) {
+    int32_t length = CopyAscii(dest, destCapacity, src, srcLength);
+    if (length >= 0) {
+      Terminate(dest, destCapacity, length, pDestLength, pErrorCode);
+      return dest;
+    }
+  }
+  return native_bridge_host_u_strFromUTF8(dest, destCapacity, pDestLength, src, srcLength,
+                                          pErrorCode);
+}
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Messages are formatted by the guest liblog anyway. Instead of running the
+// logd write path translated for each of them, queue them in a per-thread
+// batch and pass whole batches to the host liblog.
+//
+// A batch is flushed when it is full, when a message of priority ERROR or
+// higher is logged, when its thread exits, or by a flusher thread once it has
+// been pending for a flusher period. FATAL messages and exit() flush all
+// batches. Records carry their own time, so logd still sorts them correctly
+// when batches of one thread reach the host out of order.
+//
+// This needs native_bridge_android_log_write_batch() on the host, so it is
+// only built with NATIVE_BRIDGE_GUEST_LIBLOG_BATCHING defined.
+
+#if defined(NATIVE_BRIDGE_GUEST_LIBLOG_BATCHING)
+
+#include <android/log.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <new>
+
+#include "native_bridge_support/liblog/log_batch.h"
+
+extern "C" void native_bridge_android_log_write_batch(const void* records, size_t size);
+
+namespace {
+
+constexpr size_t kBatchCapacity = 8 * 1024;
+
+// Longest tag and message kept, same as logd's payload limit.
+constexpr size_t kMaxStringLength = 4068;
+
+constexpr int kImmediateFlushPriority = ANDROID_LOG_ERROR;
+
+constexpr timespec kFlusherPeriod = {0, 100'000'000};
+
+struct LogBatch {
+  // Guards size and first_record_pass. Only the owning thread adds records,
+  // so it may write them out after taking them with the lock released.
+  pthread_mutex_t lock;
+  // Next batch in g_batches.
+  LogBatch* next;
+  size_t size;
+  // Flusher pass during which the first pending record was added.
+  unsigned first_record_pass;
+  // Set while the owning thread is logging. A signal handler that logs on the
+  // same thread then writes directly instead of waiting for itself.
+  std::atomic<bool> busy;
+  alignas(NativeBridgeLogRecord) char data[kBatchCapacity];
+};
+
+// Records taken from batches, to be written after the locks are released.
+struct TakenRecords {
+  char* data = nullptr;
+  size_t size = 0;
+  size_t capacity = 0;
+};
+
+// Lock order is g_batches_lock, then LogBatch::lock. Neither is held while
+// writing to the host, except across fork().
+pthread_mutex_t g_batches_lock = PTHREAD_MUTEX_INITIALIZER;
+LogBatch* g_batches;
+bool g_flusher_running;
+
+std::atomic<unsigned> g_flusher_pass;
+
+pthread_once_t g_init_once = PTHREAD_ONCE_INIT;
+pthread_key_t g_batch_key;
+
+// Called by the owning thread. Writes out the batch's records.
+void FlushOwnBatch(LogBatch* batch) {
+  pthread_mutex_lock(&batch->lock);
+  size_t size = batch->size;
+  batch->size = 0;
+  pthread_mutex_unlock(&batch->lock);
+  if (size != 0) {
+    native_bridge_android_log_write_batch(batch->data, size);
+  }
+}
+
+// Called by the owning thread with batch->lock held.
+bool AppendRecord(LogBatch* batch, const __android_log_message* log_message) {
+  const char* tag = log_message->tag != nullptr ? log_message->tag : "";
+  const char* message = log_message->message != nullptr ? log_message->message : "";
+  size_t tag_length = strnlen(tag, kMaxStringLength);
+  size_t message_length = strnlen(message, kMaxStringLength);
+
+  size_t size = sizeof(NativeBridgeLogRecord) + tag_length + 1 + message_length + 1;
+  size = (size + alignof(NativeBridgeLogRecord) - 1) & ~(alignof(NativeBridgeLogRecord) - 1);
+  if (size > kBatchCapacity - batch->size) {
+    return false;
+  }
+
+  char* data = batch->data + batch->size;
+  auto record = reinterpret_cast<NativeBridgeLogRecord*>(data);
+  record->size = size;
+  record->buffer_id = log_message->buffer_id;
+  record->priority = log_message->priority;
+  record->tid = gettid();
+  timespec now;
+  clock_gettime(CLOCK_REALTIME, &now);
+  record->tv_sec = now.tv_sec;
+  record->tv_nsec = now.tv_nsec;
+  record->tag_length = tag_length;
+
+  char* tag_copy = data + sizeof(NativeBridgeLogRecord);
+  memcpy(tag_copy, tag, tag_length);
+  tag_copy[tag_length] = '\0';
+  char* message_copy = tag_copy + tag_length + 1;
+  memcpy(message_copy, message, message_length);
+  message_copy[message_length] = '\0';
+
+  if (batch->size == 0) {
+    batch->first_record_pass = g_flusher_pass.load(std::memory_order_relaxed);
+  }
+  batch->size += size;
+  return true;
+}
+
+// Called with g_batches_lock held. Moves the records of every batch into
+// taken, except for batches whose first record was added during keep_pass.
+// Returns whether any records are left in the batches.
+bool TakeRecordsLocked(TakenRecords* taken, const unsigned* keep_pass) {
+  bool pending = false;
+  for (LogBatch* batch = g_batches; batch != nullptr; batch = batch->next) {
+    pthread_mutex_lock(&batch->lock);
+    if (batch->size != 0 && (keep_pass == nullptr || batch->first_record_pass != *keep_pass)) {
+      size_t size = taken->size + batch->size;
+      if (size > taken->capacity) {
+        void* data = realloc(taken->data, size);
+        if (data != nullptr) {
+          taken->data = static_cast<char*>(data);
+          taken->capacity = size;
+        }
+      }
+      // Without memory, leave the records for the next flush.
+      if (size <= taken->capacity) {
+        memcpy(taken->data + taken->size, batch->data, batch->size);
+        taken->size = size;
+        batch->size = 0;
+      }
+    }
+    pending |= batch->size != 0;
+    pthread_mutex_unlock(&batch->lock);
+  }
+  return pending;
+}
+
+void WriteTakenRecords(TakenRecords* taken) {
+  if (taken->size != 0) {
+    native_bridge_android_log_write_batch(taken->data, taken->size);
+    taken->size = 0;
+  }
+}
+
+void FlushAllBatches() {
+  TakenRecords taken;
+  pthread_mutex_lock(&g_batches_lock);
+  TakeRecordsLocked(&taken, nullptr);
+  pthread_mutex_unlock(&g_batches_lock);
+  WriteTakenRecords(&taken);
+  free(taken.data);
+}
+
+void* FlusherThread(void*) {
+  TakenRecords taken;
+  bool pending = true;
+  while (pending) {
+    nanosleep(&kFlusherPeriod, nullptr);
+    unsigned pass = g_flusher_pass.fetch_add(1, std::memory_order_relaxed);
+
+    pthread_mutex_lock(&g_batches_lock);
+    // Leave records added during the last period for the next pass.
+    pending = TakeRecordsLocked(&taken, &pass);
+    if (!pending) {
+      // Loggers restart the flusher when they add to an empty batch.
+      g_flusher_running = false;
+    }
+    pthread_mutex_unlock(&g_batches_lock);
+
+    WriteTakenRecords(&taken);
+  }
+  free(taken.data);
+  return nullptr;
+}
+
+void EnsureFlusherRunning() {
+  pthread_mutex_lock(&g_batches_lock);
+  if (!g_flusher_running) {
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_t thread;
+    // If this fails, records wait for the next flush of another kind.
+    g_flusher_running = pthread_create(&thread, &attr, FlusherThread, nullptr) == 0;
+    pthread_attr_destroy(&attr);
+  }
+  pthread_mutex_unlock(&g_batches_lock);
+}
+
+void DestroyBatch(void* arg) {
+  auto batch = static_cast<LogBatch*>(arg);
+  pthread_mutex_lock(&g_batches_lock);
+  for (LogBatch** link = &g_batches; *link != nullptr; link = &(*link)->next) {
+    if (*link == batch) {
+      *link = batch->next;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&g_batches_lock);
+
+  FlushOwnBatch(batch);
+  pthread_mutex_destroy(&batch->lock);
+  free(batch);
+}
+
+// Flush everything before fork() so that neither process logs the other's
+// records, and keep the locks held so that the child gets them unlocked.
+void PrepareFork() {
+  pthread_mutex_lock(&g_batches_lock);
+  for (LogBatch* batch = g_batches; batch != nullptr; batch = batch->next) {
+    pthread_mutex_lock(&batch->lock);
+    if (batch->size != 0) {
+      native_bridge_android_log_write_batch(batch->data, batch->size);
+      batch->size = 0;
+    }
+  }
+}
+
+void UnlockAfterFork() {
+  for (LogBatch* batch = g_batches; batch != nullptr; batch = batch->next) {
+    pthread_mutex_unlock(&batch->lock);
+  }
+  pthread_mutex_unlock(&g_batches_lock);
+}
+
+void ChildAfterFork() {
+  // The flusher thread does not exist in the child.
+  g_flusher_running = false;
+  UnlockAfterFork();
+}
+
+void InitOnce() {
+  pthread_key_create(&g_batch_key, DestroyBatch);
+  pthread_atfork(PrepareFork, UnlockAfterFork, ChildAfterFork);
+  // The main thread's batch isn't destroyed on exit().
+  atexit(FlushAllBatches);
+}
+
+// Returns the calling thread's batch marked busy, or null if the thread is
+// already logging or has no batch.
+LogBatch* EnterThreadBatch() {
+  pthread_once(&g_init_once, InitOnce);
+  auto batch = static_cast<LogBatch*>(pthread_getspecific(g_batch_key));
+  if (batch != nullptr) {
+    if (batch->busy.exchange(true, std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    return batch;
+  }
+
+  batch = static_cast<LogBatch*>(malloc(sizeof(LogBatch)));
+  if (batch == nullptr) {
+    return nullptr;
+  }
+  pthread_mutex_init(&batch->lock, nullptr);
+  batch->size = 0;
+  batch->first_record_pass = 0;
+  new (&batch->busy) std::atomic<bool>(true);
+  pthread_setspecific(g_batch_key, batch);
+
+  pthread_mutex_lock(&g_batches_lock);
+  batch->next = g_batches;
+  g_batches = batch;
+  pthread_mutex_unlock(&g_batches_lock);
+  return batch;
+}
+
+void LeaveThreadBatch(LogBatch* batch) {
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  batch->busy.store(false, std::memory_order_relaxed);
+}
+
+void BatchingLogger(const __android_log_message* log_message) {
+  LogBatch* batch = EnterThreadBatch();
+  if (batch == nullptr) {
+    __android_log_logd_logger(log_message);
+    return;
+  }
+
+  pthread_mutex_lock(&batch->lock);
+  bool was_empty = batch->size == 0;
+  bool appended = AppendRecord(batch, log_message);
+  pthread_mutex_unlock(&batch->lock);
+  if (!appended) {
+    FlushOwnBatch(batch);
+    was_empty = true;
+    pthread_mutex_lock(&batch->lock);
+    appended = AppendRecord(batch, log_message);
+    pthread_mutex_unlock(&batch->lock);
+    if (!appended) {
+      // Can't happen with the length limits above, but don't lose the message.
+      LeaveThreadBatch(batch);
+      __android_log_logd_logger(log_message);
+      return;
+    }
+  }
+
+  if (log_message->priority >= ANDROID_LOG_FATAL) {
+    FlushAllBatches();
+  } else if (log_message->priority >= kImmediateFlushPriority) {
+    FlushOwnBatch(batch);
+  } else if (was_empty) {
+    EnsureFlusherRunning();
+  }
+  LeaveThreadBatch(batch);
+}
+
+}  // namespace
+
+static void __attribute__((constructor)) init_batching_logger() {
+  __android_log_set_logger(BatchingLogger);
+}
+
+#endif  // defined(NATIVE_BRIDGE_GUEST_LIBLOG_BATCHING)
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_BRIDGE_SUPPORT_LIBLOG_LOG_BATCH_H_
+#define NATIVE_BRIDGE_SUPPORT_LIBLOG_LOG_BATCH_H_
+
+#include <stdint.h>
+
+// The guest liblog hands log messages to the host in batches. A batch is a
+// sequence of records, each made of this header, the NUL-terminated tag, the
+// NUL-terminated message and padding up to the alignment of the header.
+struct NativeBridgeLogRecord {
+  // Size of the whole record, including the header, strings and padding.
+  uint32_t size;
+
+  // The log_id_t and android_LogPriority of the message.
+  int32_t buffer_id;
+  int32_t priority;
+
+  // The thread that logged the message, and when, in CLOCK_REALTIME. The host
+  // writes the message with these rather than with the time it gets the batch
+  // and the thread that flushes it.
+  int32_t tid;
+  uint32_t tv_sec;
+  uint32_t tv_nsec;
+
+  // Length of the tag, not counting its NUL. The message follows the NUL.
+  uint32_t tag_length;
+};
+
+#endif  // NATIVE_BRIDGE_SUPPORT_LIBLOG_LOG_BATCH_H_
@@ -0,0 +1,103 @@
+//
+// Copyright (C) 2026 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// clang-format off
+#include "native_bridge_support/vdso/interceptable_functions.h"
+
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(acos);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(acosf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(asin);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(asinf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(atan);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(atan2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(atan2f);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(atanf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(cbrt);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(cbrtf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(cos);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(cosf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(cosh);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(coshf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(exp);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(exp2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(exp2f);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(expf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(expm1);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(expm1f);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(log);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(log10);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(log10f);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(log1p);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(log1pf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(log2);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(log2f);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(logf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(pow);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(powf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sin);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sincos);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sincosf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sinf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sinh);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(sinhf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(tan);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(tanf);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(tanh);
+DEFINE_INTERCEPTABLE_STUB_FUNCTION(tanhf);
+
+static void __attribute__((constructor(0))) init_stub_library() {
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", acos);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", acosf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", asin);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", asinf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", atan);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", atan2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", atan2f);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", atanf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", cbrt);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", cbrtf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", cos);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", cosf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", cosh);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", coshf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", exp);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", exp2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", exp2f);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", expf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", expm1);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", expm1f);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", log);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", log10);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", log10f);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", log1p);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", log1pf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", log2);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", log2f);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", logf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", pow);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", powf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", sin);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", sincos);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", sincosf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", sinf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", sinh);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", sinhf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", tan);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", tanf);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", tanh);
+  INIT_INTERCEPTABLE_STUB_FUNCTION("libm.so", tanhf);
+}
+// clang-format on
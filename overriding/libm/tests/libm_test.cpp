@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dlfcn.h>
+#include <fenv.h>
+#include <math.h>
+#include <string.h>
+
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+// Calls in this file resolve to bionic's libm, linked statically. The same
+// functions looked up in the libm.so handle are the guest libm's, which
+// forward to the host. Forwarding must not be observable: results must be
+// bit-identical and raise the same floating-point exceptions, in every
+// rounding mode. A function that fails here goes back to the guest, by
+// removing it from stubs_*.cpp.
+
+#pragma STDC FENV_ACCESS ON
+
+namespace {
+
+constexpr int kSteps = 4096;
+// Fewer for the binary functions, which sweep both arguments.
+constexpr int kBinarySteps = 128;
+
+constexpr int kRoundingModes[] = {FE_TONEAREST, FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO};
+
+void* GuestLibm() {
+  static void* handle = dlopen("libm.so", RTLD_NOW);
+  return handle;
+}
+
+template <typename T>
+T LookUp(const char* name) {
+  void* symbol = dlsym(GuestLibm(), name);
+  if (symbol == nullptr) {
+    ADD_FAILURE() << name << ": " << dlerror();
+    abort();
+  }
+  return reinterpret_cast<T>(symbol);
+}
+
+// A result and the exceptions raised computing it.
+template <typename F>
+struct Outcome {
+  F value;
+  int exceptions;
+};
+
+template <typename F, typename Function, typename... Args>
+Outcome<F> Call(Function function, Args... args) {
+  feclearexcept(FE_ALL_EXCEPT);
+  F value = function(args...);
+  return {value, fetestexcept(FE_ALL_EXCEPT)};
+}
+
+template <typename F>
+::testing::AssertionResult Same(const char* name, F arg, const Outcome<F>& expected,
+                                const Outcome<F>& actual) {
+  // NaN payloads aren't specified, any NaN will do.
+  bool same_value = (isnan(expected.value) && isnan(actual.value)) ||
+                    memcmp(&expected.value, &actual.value, sizeof(F)) == 0;
+  if (same_value && expected.exceptions == actual.exceptions) {
+    return ::testing::AssertionSuccess();
+  }
+  return ::testing::AssertionFailure()
+         << name << "(" << std::hexfloat << arg << ") in rounding mode " << fegetround()
+         << " is " << actual.value << " raising " << actual.exceptions << ", bionic returns "
+         << expected.value << " raising " << expected.exceptions;
+}
+
+// Special values, then a sweep of [lo, hi].
+template <typename F>
+std::vector<F> Inputs(F lo, F hi, int steps = kSteps) {
+  std::vector<F> inputs = {
+      F(0),
+      -F(0),
+      F(1),
+      F(-1),
+      std::numeric_limits<F>::denorm_min(),
+      std::numeric_limits<F>::min(),
+      std::numeric_limits<F>::max(),
+      -std::numeric_limits<F>::max(),
+      std::numeric_limits<F>::infinity(),
+      -std::numeric_limits<F>::infinity(),
+      std::numeric_limits<F>::quiet_NaN(),
+  };
+  for (int i = 0; i <= steps; ++i) {
+    inputs.push_back(lo + (hi - lo) * i / steps);
+  }
+  return inputs;
+}
+
+// Runs check() in each rounding mode.
+template <typename Check>
+void InEachRoundingMode(Check check) {
+  for (int mode : kRoundingModes) {
+    fesetround(mode);
+    check();
+  }
+  fesetround(FE_TONEAREST);
+}
+
+template <typename F>
+void CheckUnary(const char* name, F (*bionic)(F), F lo, F hi) {
+  auto guest = LookUp<F (*)(F)>(name);
+  InEachRoundingMode([&] {
+    for (F x : Inputs(lo, hi)) {
+      EXPECT_TRUE(Same(name, x, Call<F>(bionic, x), Call<F>(guest, x)));
+    }
+  });
+}
+
+template <typename F>
+void CheckBinary(const char* name, F (*bionic)(F, F), F lo, F hi, F y_lo, F y_hi) {
+  auto guest = LookUp<F (*)(F, F)>(name);
+  InEachRoundingMode([&] {
+    for (F y : Inputs(y_lo, y_hi, kBinarySteps)) {
+      for (F x : Inputs(lo, hi, kBinarySteps)) {
+        EXPECT_TRUE(Same(name, x, Call<F>(bionic, x, y), Call<F>(guest, x, y))) << "with y = " << y;
+      }
+    }
+  });
+}
+
+// sincos() and sincosf() compared with bionic's sin() and cos().
+template <typename F>
+void CheckSinCos(const char* name, F (*bionic_sin)(F), F (*bionic_cos)(F)) {
+  auto guest = LookUp<void (*)(F, F*, F*)>(name);
+  InEachRoundingMode([&] {
+    for (F x : Inputs(F(-1e4), F(1e4))) {
+      F sin_x;
+      F cos_x;
+      feclearexcept(FE_ALL_EXCEPT);
+      guest(x, &sin_x, &cos_x);
+      int guest_exceptions = fetestexcept(FE_ALL_EXCEPT);
+      Outcome<F> bionic_sin_x = Call<F>(bionic_sin, x);
+      Outcome<F> bionic_cos_x = Call<F>(bionic_cos, x);
+      EXPECT_TRUE(Same(name, x, bionic_sin_x, {sin_x, bionic_sin_x.exceptions}));
+      EXPECT_TRUE(Same(name, x, bionic_cos_x, {cos_x, bionic_cos_x.exceptions}));
+      EXPECT_EQ(bionic_sin_x.exceptions | bionic_cos_x.exceptions, guest_exceptions)
+          << name << "(" << std::hexfloat << x << ")";
+    }
+  });
+}
+
+#define CHECK_UNARY(name, lo, hi)                  \
+  TEST(NativeBridgeGuestLibmTest, name) {          \
+    CheckUnary<double>(#name, name, lo, hi);       \
+  }                                                \
+  TEST(NativeBridgeGuestLibmTest, name##f) {       \
+    CheckUnary<float>(#name "f", name##f, lo, hi); \
+  }
+
+CHECK_UNARY(acos, -1, 1)
+CHECK_UNARY(asin, -1, 1)
+CHECK_UNARY(atan, -1e6, 1e6)
+CHECK_UNARY(cbrt, -1e6, 1e6)
+CHECK_UNARY(cos, -1e4, 1e4)
+CHECK_UNARY(cosh, -100, 100)
+CHECK_UNARY(exp, -750, 710)
+CHECK_UNARY(exp2, -1080, 1030)
+CHECK_UNARY(expm1, -50, 710)
+CHECK_UNARY(log, 0, 1e6)
+CHECK_UNARY(log10, 0, 1e6)
+CHECK_UNARY(log1p, -1, 1e6)
+CHECK_UNARY(log2, 0, 1e6)
+CHECK_UNARY(sin, -1e4, 1e4)
+CHECK_UNARY(sinh, -100, 100)
+CHECK_UNARY(tan, -1e4, 1e4)
+CHECK_UNARY(tanh, -30, 30)
+
+#undef CHECK_UNARY
+
+TEST(NativeBridgeGuestLibmTest, atan2) {
+  CheckBinary<double>("atan2", atan2, -10, 10, -10, 10);
+}
+
+TEST(NativeBridgeGuestLibmTest, atan2f) {
+  CheckBinary<float>("atan2f", atan2f, -10, 10, -10, 10);
+}
+
+TEST(NativeBridgeGuestLibmTest, pow) {
+  CheckBinary<double>("pow", pow, -100, 100, -20, 20);
+}
+
+TEST(NativeBridgeGuestLibmTest, powf) {
+  CheckBinary<float>("powf", powf, -100, 100, -20, 20);
+}
+
+TEST(NativeBridgeGuestLibmTest, sincos) {
+  CheckSinCos<double>("sincos", sin, cos);
+}
+
+TEST(NativeBridgeGuestLibmTest, sincosf) {
+  CheckSinCos<float>("sincosf", sinf, cosf);
+}
+
+}  // namespace
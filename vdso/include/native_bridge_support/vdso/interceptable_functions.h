@@ -52,4 +52,9 @@
 #define INIT_INTERCEPTABLE_STUB_FUNCTION(library_name, name) \
   native_bridge_intercept_symbol(reinterpret_cast<void*>(name), library_name, #name)
 
+// Same as above, for a stub that is named differently from the host symbol it
+// forwards to. Used when the guest library itself defines the host symbol name.
+#define INIT_INTERCEPTABLE_STUB_FUNCTION_WITH_NAME(library_name, name, symbol_name) \
+  native_bridge_intercept_symbol(reinterpret_cast<void*>(name), library_name, symbol_name)
+
 #endif  // NATIVE_BRIDGE_SUPPORT_VDSO_INTERCEPTABLE_FUNCTIONS_H_